@@ -118,138 +118,146 @@ adal_t * adal_sbefifo_open(const char * device, int flags) {
 	return &sbefifo->adal;
 }
 
-ssize_t adal_sbefifo_submit(adal_t * adal, adal_sbefifo_request * request,
-		adal_sbefifo_reply * reply, unsigned long timeout_in_msec) {
+/*
+ * A write can be refused with EAGAIN while the fifo is still busy with the
+ * previous request, even after poll() said it was writable.  Back off starting
+ * at a few microseconds and doubling up to 1ms, instead of always sleeping 1ms,
+ * for up to ADAL_SBEFIFO_BUSY_LIMIT_MS in total.
+ */
+#define ADAL_SBEFIFO_BACKOFF_MIN_NS	5000ull
+#define ADAL_SBEFIFO_BACKOFF_MAX_NS	1000000ull
+#define ADAL_SBEFIFO_BUSY_LIMIT_MS	10000ull
 
-	int rc = -1;
+static uint64_t adal_sbefifo_now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ull) + (uint64_t) now.tv_nsec;
+}
 
+/* 0 once the fifo is ready for 'events', -1 on POLLERR, a failing poll or a timeout (errno ETIMEDOUT) */
+static int adal_sbefifo_wait(adal_t * adal, short events, unsigned long timeout_in_msec)
+{
 	struct pollfd pollfd;
-	int ret = 0;
+	int ret;
 
 	pollfd.fd = adal->fd;
-	pollfd.events = POLLOUT | POLLERR;
+	pollfd.events = events | POLLERR;
+	pollfd.revents = 0;
 
-	if((ret = poll(&pollfd, 1, timeout_in_msec)) < 0) {
+	ret = poll(&pollfd, 1, timeout_in_msec);
+	if (ret < 0) {
 		//perror("Waiting for fifo device failed");
 		return -1;
 	}
 
-	if (pollfd.revents & POLLERR) {
+	if (ret == 0) {
+		errno = ETIMEDOUT;
+		return -1;
+	}
 
+	if (pollfd.revents & POLLERR) {
+		//fprintf(stderr, "POLLERR while waiting for fifo\n");
 		return -1;
 	}
 
+	return 0;
+}
+
+static ssize_t adal_sbefifo_send(adal_t * adal, adal_sbefifo_request * request,
+		unsigned long timeout_in_msec) {
+
 	uint8_t * buf = (uint8_t *) request->data;
 	int size_bytes = request->wordcount << 2;
-        if ( adal_is_byte_swap_needed() ) {
-                uint32_t *tmpBuf = (uint32_t *) request->data;
-                for ( uint32_t idx = 0; idx < request->wordcount; idx++ ){
-                        tmpBuf[idx] = htonl(tmpBuf[idx]);
-                }
-        }
-	ret = write(adal->fd, buf, size_bytes);
-	if (ret < 0) {
-		//perror("Writing user input failed");
-        bool retry = false;
-        if (errno == EAGAIN)
-        {
-            retry = true;
-        }
-        else
-        {
-            return -1;
-        }
-        // sleep and retry up to 10000 times
-        uint32_t retry_count = 0;
-        const uint32_t retry_limit = 10000;
-        while (retry)
-        {
-            delay(1000000); // sleep 1ms
-	        size_bytes = request->wordcount << 2;
-
-	        pollfd.fd = adal->fd;
-	        pollfd.events = POLLOUT | POLLERR;
-
-	        if((ret = poll(&pollfd, 1, timeout_in_msec)) < 0) {
-		        //perror("Waiting for fifo device failed");
-		        return -1;
-	        }
-
-	        if (pollfd.revents & POLLERR) {
-		        return -1;
-	        }
-
-	        ret = write(adal->fd, buf, size_bytes);
-            if (ret < 0)
-            {
-		        //perror("Writing user input retry failed");
-                if (errno == EAGAIN)
-                {
-                    retry_count++;
-                    // too many retries, fail
-                    if (retry_count > retry_limit)
-                    {
-                        return -1;
-                    }
-                }
-                else
-                {
-                    return -1;
-                }
-            }
-            else
-            {
-                // write succeeded, exit loop
-                retry = false;
-            }
-        }
-	}
-    if (ret != size_bytes) {
-		//fprintf(stderr, "Incorrect number of bytes written %d != %d\n", ret, size_bytes);
-		return -1;
+	uint64_t backoff = ADAL_SBEFIFO_BACKOFF_MIN_NS;
+	uint64_t busy_deadline = 0;
+	int ret;
+
+	if (adal_is_byte_swap_needed()) {
+		uint32_t *tmpBuf = (uint32_t *) request->data;
+		for (uint32_t idx = 0; idx < request->wordcount; idx++) {
+			tmpBuf[idx] = htonl(tmpBuf[idx]);
+		}
 	}
 
-	pollfd.fd = adal->fd;
-	pollfd.events = POLLIN | POLLERR;
+	while (1) {
+		if (adal_sbefifo_wait(adal, POLLOUT, timeout_in_msec))
+			return -1;
 
-	if((ret = poll(&pollfd, 1, timeout_in_msec) < 0)) {
-		//perror("Waiting for fifo device failed");
-		return -1;
+		ret = write(adal->fd, buf, size_bytes);
+		if (ret >= 0)
+			break;
+		if (errno != EAGAIN) {
+			//perror("Writing user input failed");
+			return -1;
+		}
+
+		uint64_t now = adal_sbefifo_now_ns();
+		if (busy_deadline == 0) {
+			busy_deadline = now + (ADAL_SBEFIFO_BUSY_LIMIT_MS * 1000000ull);
+		} else if (now >= busy_deadline) {
+			// busy for too long, fail
+			errno = EAGAIN;
+			return -1;
+		}
+
+		delay(backoff);
+		if (backoff < ADAL_SBEFIFO_BACKOFF_MAX_NS)
+			backoff <<= 1;
 	}
 
-	if (pollfd.revents & POLLERR) {
-		//fprintf(stderr, "POLLERR while waiting for readable fifo\n");
+	if (ret != size_bytes) {
+		//fprintf(stderr, "Incorrect number of bytes written %d != %d\n", ret, size_bytes);
 		return -1;
 	}
 
-	buf = (uint8_t *) reply->data;
+	return ret;
+}
+
+static ssize_t adal_sbefifo_complete(adal_t * adal, adal_sbefifo_reply * reply,
+		unsigned long timeout_in_msec) {
+
+	uint8_t * buf = (uint8_t *) reply->data;
 	int ret_bytes = 0;
-	size_bytes = reply->wordcount << 2;
+	int size_bytes = reply->wordcount << 2;
+	int ret;
+
+	if (adal_sbefifo_wait(adal, POLLIN, timeout_in_msec))
+		return -1;
+
 	while (size_bytes > 0) {
-		if((ret = read(adal->fd, buf + ret_bytes, size_bytes)) < 0) {
+		if ((ret = read(adal->fd, buf + ret_bytes, size_bytes)) < 0) {
 			if (errno == EAGAIN)
 				break;
 			//perror("Reading fifo device failed");
 			return -1;
 		}
+		if (ret == 0)
+			break;
 		ret_bytes += ret;
 		size_bytes -= ret;
 	}
 
-
 	reply->wordcount = ret_bytes >> 2;
 
-        if ( adal_is_byte_swap_needed() ) {
-                uint32_t *tmpBuf = (uint32_t *) reply->data;
-                for ( uint32_t idx = 0; idx < reply->wordcount; idx++ ){
-                        tmpBuf[idx] = ntohl(tmpBuf[idx]);
-                }
-        }
+	if (adal_is_byte_swap_needed()) {
+		uint32_t *tmpBuf = (uint32_t *) reply->data;
+		for (uint32_t idx = 0; idx < reply->wordcount; idx++) {
+			tmpBuf[idx] = ntohl(tmpBuf[idx]);
+		}
+	}
 
-	rc = ret_bytes;
+	return ret_bytes;
+}
 
-	return rc;
+ssize_t adal_sbefifo_submit(adal_t * adal, adal_sbefifo_request * request,
+		adal_sbefifo_reply * reply, unsigned long timeout_in_msec) {
+
+	if (adal_sbefifo_send(adal, request, timeout_in_msec) < 0)
+		return -1;
 
+	return adal_sbefifo_complete(adal, reply, timeout_in_msec);
 }
 
 int adal_sbefifo_close(adal_t * adal) {
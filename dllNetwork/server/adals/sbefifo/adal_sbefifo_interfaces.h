@@ -128,6 +128,13 @@ int adal_sbefifo_close(adal_t * adal);
  * 			upstream fifo, the functions will return immediatly with -1 and
  * 			errno set to EBUSY
  *
+ * @note	One request and its reply per call, the request goes out in a single
+ *			write() since the driver takes each write() as a whole command.
+ *			The fifo is waited on with poll() for room and for the reply, a
+ *			write() still refused with EAGAIN is retried with a short backoff.
+ *			Callers with several requests for one fifo submit them one after
+ *			the other.
+ *
  * @param	adal		adal_t of the target device.
  * @param	adal_sbefifo_request		- containing:
  * 				void * data     		- in: data pointer containing the request 
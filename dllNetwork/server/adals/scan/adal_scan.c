@@ -69,11 +69,6 @@ int adal_scan_close(adal_t * adal)
 {
 	int rc = 0;
 
-    if (adal != NULL) {
-        free(adal->priv);
-    }
-
-
     if (adal != NULL) {
         free(adal->priv);
     }
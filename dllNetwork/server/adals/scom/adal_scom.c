@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <errno.h>
 #include <arpa/inet.h>
 #include <sys/ioctl.h>
 #include "adal_scom.h"
@@ -332,6 +333,149 @@ ssize_t adal_scom_write_under_mask(adal_t * adal, void * buf, uint64_t scom_addr
 	return 8;
 }
 
+/* Open the first fsi raw file that exists, the scom engine registers live there */
+static int adal_scom_open_raw(int flags)
+{
+	int fd = -1;
+	uint32_t fsiIdx = 0;
+
+	for (fsiIdx = 0; fsiIdx < fsirawSize; fsiIdx++) {
+		fd = open(fsiraw[fsiIdx], flags);
+		if (fd != -1)
+			break;
+	}
+	return fd;
+}
+
+static void adal_scom_raw_status(adal_scom_t *scom, int rawfd, unsigned long *status)
+{
+	uint32_t reg = 0;
+
+	if (rawfd == -1)
+		return;
+
+	if (pread(rawfd, &reg, 4, scom->offset + SCOM_ENGINE_OFFSET + (STATUS * 4)) != 4)
+		return;
+
+	if (adal_is_byte_swap_needed())
+		reg = ntohl(reg);
+	*status = reg;
+}
+
+/* Same as adal_scom_legacy_read/adal_scom_legacy_write, without the seeks */
+static ssize_t adal_scom_legacy_batch_read(adal_t * adal, uint64_t * data, uint64_t scom_address)
+{
+	ssize_t rc;
+
+	if (scom_address & INDIRECT_SCOM_FLAG) {
+		uint64_t cmd = (scom_address & INDIRECT_SCOM_ADDR) | INDIRECT_SCOM_READ;
+
+		rc = pwrite(adal->fd, &cmd, SCOM_DATA_LEN, (uint32_t)(scom_address & DIRECT_SCOM_ADDR));
+		rc = pread(adal->fd, &cmd, SCOM_DATA_LEN, (uint32_t)(scom_address & DIRECT_SCOM_ADDR));
+		*data = cmd & INDIRECT_SCOM_READ_DATA;
+		return rc;
+	}
+
+	return pread64(adal->fd, data, SCOM_DATA_LEN, scom_address);
+}
+
+static ssize_t adal_scom_legacy_batch_write(adal_t * adal, uint64_t data, uint64_t scom_address)
+{
+	if (scom_address & INDIRECT_SCOM_FLAG) {
+		uint64_t cmd;
+
+		if (scom_address & FORM1_SCOM) {
+			cmd = (scom_address & FORM1_SCOM_ADDR) << FORM1_SCOM_SHIFT;
+			cmd |= (data & FORM1_SCOM_DATA);
+		}
+		else {
+			cmd = scom_address & INDIRECT_SCOM_ADDR;
+			cmd |= data;
+		}
+
+		return pwrite(adal->fd, &cmd, SCOM_DATA_LEN, (uint32_t)(scom_address & DIRECT_SCOM_ADDR));
+	}
+
+	return pwrite64(adal->fd, &data, SCOM_DATA_LEN, scom_address);
+}
+
+static ssize_t adal_scom_batch(adal_t * adal, adal_scom_batch_entry_t * entries, size_t count, bool write)
+{
+	adal_scom_t *scom;
+	int rawfd = -1;
+	size_t idx;
+
+	if (!adal || (!entries && count)) {
+		errno = EINVAL;
+		return -1;
+	}
+	scom = to_scom_adal(adal);
+
+	if (!scom->has_ioctl)
+		rawfd = adal_scom_open_raw(O_RDONLY);
+
+	for (idx = 0; idx < count; idx++) {
+		adal_scom_batch_entry_t *entry = &entries[idx];
+
+		if (scom->has_ioctl) {
+			struct scom_access acc = {};
+
+			acc.addr = entry->address;
+			if (write) {
+				acc.data = entry->data;
+				acc.mask = entry->mask;
+			}
+			entry->rc = ioctl(adal->fd, write ? FSI_SCOM_WRITE : FSI_SCOM_READ, &acc);
+			if (entry->rc == 0) {
+				if (!write)
+					entry->data = acc.data;
+				adal_scom_make_status(&acc, &entry->status);
+				entry->rc = 8;
+			}
+		}
+		else if (!write) {
+			entry->rc = adal_scom_legacy_batch_read(adal, &entry->data, entry->address);
+			// ignore rc as status is checked later
+			adal_scom_raw_status(scom, rawfd, &entry->status);
+		}
+		else {
+			uint64_t data = entry->data;
+
+			entry->rc = 8;
+			if (entry->mask) {
+				entry->rc = adal_scom_legacy_batch_read(adal, &data, entry->address);
+				adal_scom_raw_status(scom, rawfd, &entry->status);
+				data = (data & ~entry->mask) | (entry->data & entry->mask);
+			}
+			if (entry->rc >= 0) {
+				entry->rc = adal_scom_legacy_batch_write(adal, data, entry->address);
+				// ignore rc as status is checked later
+				adal_scom_raw_status(scom, rawfd, &entry->status);
+			}
+		}
+
+		if (entry->rc != 8) {
+			idx++;
+			break;
+		}
+	}
+
+	if (rawfd != -1)
+		close(rawfd);
+
+	return idx;
+}
+
+ssize_t adal_scom_read_batch(adal_t * adal, adal_scom_batch_entry_t * entries, size_t count)
+{
+	return adal_scom_batch(adal, entries, count, false);
+}
+
+ssize_t adal_scom_write_batch(adal_t * adal, adal_scom_batch_entry_t * entries, size_t count)
+{
+	return adal_scom_batch(adal, entries, count, true);
+}
+
 ssize_t adal_scom_ffdc_extract(adal_t * adal, int scope, void ** buf)
 {
     *buf = NULL;
@@ -245,6 +245,33 @@ ssize_t adal_scom_read(adal_t * adal, void * buf, uint64_t scom_address, unsigne
 ssize_t adal_scom_write(adal_t * adal, void * buf, uint64_t scom_address,  unsigned long * status);
 ssize_t adal_scom_write_under_mask(adal_t * adal, void * buf, uint64_t scom_address, void * mask, unsigned long * status);
 
+/*!
+ * @brief	These interfaces run a list of scom reads or writes on the
+ *		underlying device associated with an adal_t in one call.
+ *
+ * @pre		The device was opened with a prior call to adal_scom_open().
+ *
+ * @note	Entries run in order and stop after the first entry whose 'rc'
+ *		is not 8, so that entry is the last one run.  'rc' and 'status'
+ *		of every entry that ran are filled in the same way as
+ *		adal_scom_read()/adal_scom_write() would have.
+ *
+ * @note	A write entry with a non-zero 'mask' is written under mask.
+ *
+ * @note	On devices without the scom ioctls the status register file is
+ *		opened once for the whole list instead of once per entry.
+ *
+ * @param	adal		adal_t of the target device.
+ * @param	entries		the list of operations, see adal_scom_batch_entry_t.
+ * @param	count		number of entries in the list.
+ *
+ * @return	The number of entries run on success, -1 on failure with
+ *		'ERRNO' set as follows.
+ * @return	EINVAL	At least one of the input parameters is invalid.
+ */
+ssize_t adal_scom_read_batch(adal_t * adal, adal_scom_batch_entry_t * entries, size_t count);
+ssize_t adal_scom_write_batch(adal_t * adal, adal_scom_batch_entry_t * entries, size_t count);
+
 /* get the FFDC Data */
 /*!
  * @brief	This interface is used to access the device's FFDC information.
@@ -149,5 +149,14 @@ typedef struct scom_v_op
 	scom_op *ops;
 } scom_v_op;
 
+typedef struct adal_scom_batch_entry
+{
+	uint64_t address;	/*!< scom address */
+	uint64_t data;		/*!< data to write, or the data read */
+	uint64_t mask;		/*!< write under mask when non-zero, unused on read */
+	unsigned long status;	/*!< scom status register for this entry */
+	ssize_t rc;		/*!< 8 on success, like adal_scom_read/adal_scom_write */
+} adal_scom_batch_entry_t;
+
 
 #endif
@@ -12,7 +12,7 @@ my $STRING = 2;
 my $BOOL = 3;
 
 #functions to ignore in parsing ecmdClientCapi.H because they don't get implemented in the dll, client only functions in ecmdClientCapi.C
-my @ignores = qw( ecmdLoadDll ecmdUnloadDll ecmdCommandArgs ecmdSetup ecmdDisplayDllInfo InitExtension cmdRunCommand ecmdFunctionTimer ecmdQueryScomGroup getScomGroup);
+my @ignores = qw( ecmdLoadDll ecmdUnloadDll ecmdCommandArgs ecmdSetup ecmdDisplayDllInfo InitExtension cmdRunCommand ecmdFunctionTimer ecmdQueryScomGroup getScomGroup ecmdLooperParallel ecmdProfile);
 my $ignore_re = join '|', @ignores;
 # Allow exceptions to be specified so the general match above doesn't match longer file names
 my @ignore_exceptions = qw( ecmdLoadDllRecovery);
@@ -28,6 +28,10 @@ my $no_gen_re = join '|', @no_gen;
 # These are functions that we want to check ring cache on.  If not added here, a function won't have ring cache checks
 my @check_ring_cache = qw(getRing putRing getScom putScom sendCmd CfamRegister getArray putArray getTraceArray putTraceArray startClocks stopClocks iSteps SystemPower FruPower Spr Fpr Gpr Slb GpRegister);
 my $check_ring_cache_re = join '|', @check_ring_cache;
+
+# These functions change which targets are configured, so the looper's topology snapshots have to be thrown away after them
+my @flush_topology = qw(ecmdSetConfiguration ecmdSetConfigurationComplex ecmdDeconfigureTarget ecmdConfigureTarget);
+my $flush_topology_re = join '|', @flush_topology;
 # These functions have variable depth and require state fields, so we can use their state fields to do ring cache check
 # Functions still need to be included above in check_ring_cache to work here
 my $check_ring_cache_state_valid = "startClocks|stopClocks";
@@ -37,6 +41,8 @@ my $DllFnTable;
 my @enumtable;
 my $dllCapiOut;
 my $functionListOut;
+my $DllFnsOut;
+my $bindOut;
 
 # If no file is given, set the all flag
 my $genAll = 0;
@@ -54,6 +60,8 @@ while (<IN>) {
 
     $dllCapiOut .= $_;
     $printout .= $_;
+    $DllFnsOut .= $_;
+    $bindOut .= $_;
 
   } elsif (/\@name/) {  # Needed for function listing
 
@@ -127,42 +135,43 @@ while (<IN>) {
     # Readded because we have functions that aren't autogenerated again JTA 09/04/2007
     next if (/$no_gen_re/o);
 
-    $printout .= "$type $orgfuncname(@argnames) {\n\n";
+    # The real work, tracing and all, goes in a static function the public wrapper below falls back to
+    my $body = "static $type ${funcname}Traced(@argnames) {\n\n";
 
 
-    $printout .= "  $type rc;\n\n" unless ($type_flag == $VOID);
+    $body .= "  $type rc;\n\n" unless ($type_flag == $VOID);
 
-    $printout .= "#ifndef ECMD_STATIC_FUNCTIONS\n";
-    $printout .= "  if (dlHandle == NULL) {\n";
-    $printout .= "    fprintf(stderr,\"$funcname\%s\",ECMD_DLL_NOT_LOADED_ERROR);\n";
-    $printout .= "    exit(ECMD_DLL_INVALID);\n";
-    $printout .= "  }\n";
+    $body .= "#ifndef ECMD_STATIC_FUNCTIONS\n";
+    $body .= "  if (dlHandle == NULL) {\n";
+    $body .= "    fprintf(stderr,\"$funcname\%s\",ECMD_DLL_NOT_LOADED_ERROR);\n";
+    $body .= "    exit(ECMD_DLL_INVALID);\n";
+    $body .= "  }\n";
 
 
-    $printout .= "#endif\n\n";
+    $body .= "#endif\n\n";
 
     if ($ARGV[0] ne "ecmd") {
-      $printout .= "  if (!".$ARGV[0]."Initialized) {\n";
-      $printout .= "    fprintf(stderr,\"$funcname: eCMD Extension not initialized before function called\\n\");\n";
-      $printout .= "    fprintf(stderr,\"$funcname: OR eCMD $ARGV[0] Extension not supported by plugin\\n\");\n";
-      $printout .= "    exit(ECMD_DLL_INVALID);\n";
-      $printout .= "  }\n\n";
+      $body .= "  if (!".$ARGV[0]."Initialized) {\n";
+      $body .= "    fprintf(stderr,\"$funcname: eCMD Extension not initialized before function called\\n\");\n";
+      $body .= "    fprintf(stderr,\"$funcname: OR eCMD $ARGV[0] Extension not supported by plugin\\n\");\n";
+      $body .= "    exit(ECMD_DLL_INVALID);\n";
+      $body .= "  }\n\n";
     }
 
     #Put the debug stuff here
     if (!($orgfuncname =~ /ecmdOutput/)) {
-      $printout .= "#ifndef ECMD_STRIP_DEBUG\n";
+      $body .= "#ifndef ECMD_STRIP_DEBUG\n";
 
       # new debug10 parm tracing stuff
       if(!($orgfuncname =~ /ecmdFunctionParmPrinter/)) {
         #if($#argnames >=-1) {
         if(1) {
-          $printout .= "  int myTcount;\n";
-          $printout .= "  std::vector< void * > args;\n";
-          $printout .= "  if (ecmdClientDebug != 0) {\n";
+          $body .= "  int myTcount;\n";
+          $body .= "  std::vector< void * > args;\n";
+          $body .= "  if (ecmdClientDebug != 0) {\n";
 
 
-          #		    $printout .= "     ecmdFunctionParmPrinter(ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\"";
+          #		    $body .= "     ecmdFunctionParmPrinter(ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\"";
 
           #
           #		    my $pp_argstring;
@@ -182,80 +191,82 @@ while (<IN>) {
 
             #			$pp_typestring .= $tmptypestring . ", ";
             #			$pp_argstring .= $tmparg . ", ";
-            $printout .= "     args.push_back((void*) &" . $tmparg . ");\n";
+            $body .= "     args.push_back((void*) &" . $tmparg . ");\n";
           }
 
           #		    chop ($pp_typestring, $pp_argstring);
           #		    chop ($pp_typestring, $pp_argstring);
-          #		    $printout .= "," . $pp_argstring . ");\n\n";
-          $printout .= "     fppCallCount++;\n";
-          $printout .= "     myTcount = fppCallCount;\n";
-          $printout .= "     ecmdFunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\",args);\n";
+          #		    $body .= "," . $pp_argstring . ");\n\n";
+          $body .= "     fppCallCount++;\n";
+          $body .= "     myTcount = fppCallCount;\n";
+          $body .= "     ecmdFunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\",args);\n";
 
           # if adding <ext>FunctionParmPrinter()
           if ($ARGV[0] eq "gip") {
-            $printout .= "     $ARGV[0]FunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\",args);\n";
+            $body .= "     $ARGV[0]FunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONIN,\"$type $orgfuncname(@argnames)\",args);\n";
           }
 
-          $printout .= "     ecmdFunctionTimer(myTcount,ECMD_TMR_FUNCTIONIN,\"$orgfuncname\");\n";
-          $printout .= "  }\n";
+          $body .= "     ecmdFunctionTimer(myTcount,ECMD_TMR_FUNCTIONIN,\"$orgfuncname\");\n";
+          $body .= "  }\n";
         } # end if there are no args
       } # end if its not ecmdFunctionParmPrinter 
-      $printout .= "#endif\n\n";
+      $body .= "#endif\n\n";
     }
 
+    my $ringcheck = "";
     if (/$check_ring_cache_re/) {
 
 
-      $printout .= "   ecmdChipTarget cacheTarget;\n";
+      $ringcheck .= "   ecmdChipTarget cacheTarget;\n";
       if (/$check_ring_cache_state_valid/) {
         # State fields should be valid to appropriate depth, so just pass through
-        $printout .= "   cacheTarget = i_target;\n";
+        $ringcheck .= "   cacheTarget = i_target;\n";
       } elsif ($chipTarget) {
-        $printout .= "   cacheTarget = i_target;\n";
-        $printout .= "   ecmdSetTargetDepth(cacheTarget, ECMD_DEPTH_CHIP);\n";
+        $ringcheck .= "   cacheTarget = i_target;\n";
+        $ringcheck .= "   ecmdSetTargetDepth(cacheTarget, ECMD_DEPTH_CHIP);\n";
       } else {
         # Temporary fix for I/P GFW so that the looper isn't called when the HOM isn't up
         # We don't do anything and just pass the cacheTarget right in
         # Also comment the while loop close up back in below
         ## Since this function doesn't take a cage, I need to loop over cages and check all caches
-        #$printout .= "   ecmdLooperData looperdata;\n";
-        #$printout .= "   cacheTarget.cageState = ECMD_TARGET_FIELD_WILDCARD;\n";
-        #$printout .= "   rc = ecmdConfigLooperInit(cacheTarget, ECMD_ALL_TARGETS_LOOP, looperdata);\n";
-        #$printout .= "   if (rc) return rc;\n\n";
-        #$printout .= "   while (ecmdConfigLooperNext(cacheTarget, looperdata)) {\n";
+        #$ringcheck .= "   ecmdLooperData looperdata;\n";
+        #$ringcheck .= "   cacheTarget.cageState = ECMD_TARGET_FIELD_WILDCARD;\n";
+        #$ringcheck .= "   rc = ecmdConfigLooperInit(cacheTarget, ECMD_ALL_TARGETS_LOOP, looperdata);\n";
+        #$ringcheck .= "   if (rc) return rc;\n\n";
+        #$ringcheck .= "   while (ecmdConfigLooperNext(cacheTarget, looperdata)) {\n";
       }
 
       if ($type_flag == $STRING) {
-        $printout .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return ecmdGetErrorMsg(ECMD_RING_CACHE_ENABLED);\n";
+        $ringcheck .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return ecmdGetErrorMsg(ECMD_RING_CACHE_ENABLED);\n";
       }
       elsif ($type_flag == $INT) {
-        $printout .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return ECMD_RING_CACHE_ENABLED;\n";
+        $ringcheck .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return ECMD_RING_CACHE_ENABLED;\n";
       }
       elsif ($type_flag == $BOOL) {
-        $printout .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return false;\n";
+        $ringcheck .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return false;\n";
       }
       else { #type is VOID
-        $printout .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return;\n";
+        $ringcheck .= "   if (ecmdIsRingCacheEnabled(cacheTarget)) return;\n";
       }
       # Close up my while loop above 
       #if (!$chipTarget) {
-      #  $printout .= "   }\n";
+      #  $ringcheck .= "   }\n";
       #}
 
     }
+    $body .= $ringcheck;
 
-    $printout .= "#ifdef ECMD_STATIC_FUNCTIONS\n";
+    $body .= "#ifdef ECMD_STATIC_FUNCTIONS\n";
 
-    $printout .= "  rc = " unless ($type_flag == $VOID);
+    $body .= "  rc = " unless ($type_flag == $VOID);
 
     $" = " ";
 
     if ($type_flag == $VOID) {
-      $printout .= "  ";
+      $body .= "  ";
     }
 
-    $printout .= $funcname . "(";
+    $body .= $funcname . "(";
 
     my $argstring;
     my $typestring;
@@ -279,9 +290,9 @@ while (<IN>) {
     chop ($typestring, $argstring);
     chop ($typestring, $argstring);
 
-    $printout .= $argstring . ");\n";
+    $body .= $argstring . ");\n";
 
-    $printout .= "#else\n";
+    $body .= "#else\n";
 
 
 
@@ -292,72 +303,148 @@ while (<IN>) {
       $DllFnTable = "DllFnTable";
     }
 
-    $printout .= "  if (".$DllFnTable."[$enumname] == NULL) {\n";
-    $printout .= "     ".$DllFnTable."[$enumname] = (void*)dlsym(dlHandle, \"$funcname\");\n";
+    $body .= "  if (".$DllFnTable."[$enumname] == NULL) {\n";
+    $body .= "     ".$DllFnTable."[$enumname] = (void*)dlsym(dlHandle, \"$funcname\");\n";
 
-    $printout .= "     if (".$DllFnTable."[$enumname] == NULL) {\n";
+    $body .= "     if (".$DllFnTable."[$enumname] == NULL) {\n";
 
-    $printout .= "       fprintf(stderr,\"$funcname\%s\",ECMD_UNABLE_TO_FIND_FUNCTION_ERROR); \n";
+    $body .= "       fprintf(stderr,\"$funcname\%s\",ECMD_UNABLE_TO_FIND_FUNCTION_ERROR); \n";
     # Defect 20342, display dll info in case of invalid symbol
-    $printout .= "       ecmdDisplayDllInfo();\n";
+    $body .= "       ecmdDisplayDllInfo();\n";
 
-    $printout .= "       exit(ECMD_DLL_INVALID);\n";
+    $body .= "       exit(ECMD_DLL_INVALID);\n";
 
-    $printout .= "     }\n";
+    $body .= "     }\n";
 
-    $printout .= "  }\n\n";
+    $body .= "  }\n\n";
 
-    $printout .= "  $type (*Function)($typestring) = \n";
-    $printout .= "      ($type(*)($typestring))".$DllFnTable."[$enumname];\n";
+    $body .= "  $type (*Function)($typestring) = \n";
+    $body .= "      ($type(*)($typestring))".$DllFnTable."[$enumname];\n";
 
-    $printout .= "  rc = " unless ($type_flag == $VOID);
-    $printout .= "   (*Function)($argstring);\n" ;
+    $body .= "  rc = " unless ($type_flag == $VOID);
+    $body .= "   (*Function)($argstring);\n" ;
 
-    $printout .= "#endif\n\n";
+    $body .= "#endif\n\n";
+
+    # Targets may have come or gone, so what the looper cached is stale
+    my $topologyflush = "";
+    if ($ARGV[0] eq "ecmd" && $orgfuncname =~ /^($flush_topology_re)$/) {
+      $topologyflush .= "  ecmdFlushTopologyCache();\n\n";
+    }
+    $body .= $topologyflush;
 
 
     #Put the debug stuff here
     if (!($orgfuncname =~ /ecmdOutput/)) {
-      $printout .= "#ifndef ECMD_STRIP_DEBUG\n";
+      $body .= "#ifndef ECMD_STRIP_DEBUG\n";
 
 
       # new debug10 parm tracing stuff
       if(!($orgfuncname =~ /ecmdFunctionParmPrinter/)) {
         #if($#argnames >=0) {
         if (1) {
-          $printout .= "  if (ecmdClientDebug != 0) {\n";
-          $printout .= "     args.push_back((void*) &rc);\n" unless ($type_flag == $VOID);
-          $printout .= "     ecmdFunctionTimer(myTcount,ECMD_TMR_FUNCTIONOUT,\"$orgfuncname\");\n";
+          $body .= "  if (ecmdClientDebug != 0) {\n";
+          $body .= "     args.push_back((void*) &rc);\n" unless ($type_flag == $VOID);
+          $body .= "     ecmdFunctionTimer(myTcount,ECMD_TMR_FUNCTIONOUT,\"$orgfuncname\");\n";
           $" = ","; # So we put commas between the tokens in argnames
-          $printout .= "     ecmdFunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONOUT,\"$type $orgfuncname(@argnames)\",args);\n";
+          $body .= "     ecmdFunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONOUT,\"$type $orgfuncname(@argnames)\",args);\n";
 
           # if adding <ext>FunctionParmPrinter()
           if ($ARGV[0] eq "gip") {
-            $printout .= "     $ARGV[0]FunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONOUT,\"$type $orgfuncname(@argnames)\",args);\n";
+            $body .= "     $ARGV[0]FunctionParmPrinter(myTcount,ECMD_FPP_FUNCTIONOUT,\"$type $orgfuncname(@argnames)\",args);\n";
           }
 
 
           #	    
-          $printout .= "   }\n";
+          $body .= "   }\n";
         } # end if there are no args
       } # end if its not ecmdFunctionParmPrinter 
 
-      $printout .= "#endif\n\n";
+      $body .= "#endif\n\n";
     }
 
     # Call dllGetErrorMsg to print any plugin errors to the screen
+    my $errorcheck = "";
     if ($type_flag == $INT) {
-      $printout .= "  if (rc && !ecmdGetGlobalVar(ECMD_GLOBALVAR_QUIETERRORMODE)) {\n";
-      $printout .= "    std::string errorString;\n";
+      $errorcheck .= "  if (rc && !ecmdGetGlobalVar(ECMD_GLOBALVAR_QUIETERRORMODE)) {\n";
+      $errorcheck .= "    std::string errorString;\n";
       # If ECMD_GLOBALVAR_CMDLINEMODE is set, that will return true, which is what we want to pass in
-      $printout .= "    errorString = ecmdGetErrorMsg(rc, false, ecmdGetGlobalVar(ECMD_GLOBALVAR_CMDLINEMODE), false);\n";
-      $printout .= "    if (errorString.size()) ecmdOutput(errorString.c_str());\n";
-      $printout .= "  }\n\n";
+      $errorcheck .= "    errorString = ecmdGetErrorMsg(rc, false, ecmdGetGlobalVar(ECMD_GLOBALVAR_CMDLINEMODE), false);\n";
+      $errorcheck .= "    if (errorString.size()) ecmdOutput(errorString.c_str());\n";
+      $errorcheck .= "  }\n\n";
     }
+    $body .= $errorcheck;
 
-    $printout .= "  return rc;\n" unless ($type_flag == $VOID);
+    $body .= "  return rc;\n" unless ($type_flag == $VOID);
+
+    $body .= "}\n\n";
+
+    # The public wrapper - when the plugin function was bound up front and nobody is tracing or profiling, go straight to it
+    my $DllFns;
+    if ($ARGV[0] ne "ecmd") {
+      $DllFns = "$ARGV[0]DllFns";
+    } else {
+      $DllFns = "DllFns";
+    }
+    $" = ",";
+    $printout .= "static $type ${funcname}Traced(@argnames);\n\n";
+    $printout .= "$type $orgfuncname(@argnames) {\n\n";
+    # Output from a thread that is capturing it is queued instead of going to the plugin
+    my %captureTypes = ("ecmdOutput" => "ECMD_LOOPER_OUTPUT", "ecmdOutputWarning" => "ECMD_LOOPER_OUTPUT_WARNING", "ecmdOutputError" => "ECMD_LOOPER_OUTPUT_ERROR");
+    if ($ARGV[0] eq "ecmd" && exists $captureTypes{$orgfuncname}) {
+      $printout .= "  if (ecmdLooperParallelCaptured(i_message, $captureTypes{$orgfuncname})) return;\n\n";
+    }
+    $printout .= "#ifndef ECMD_STATIC_FUNCTIONS\n";
+    # ecmdClientDebug can be raised after the load, so it's looked at on every call rather than at bind time
+    my $fastcheck = "$DllFns.$funcname != NULL";
+    $fastcheck .= " && ".$ARGV[0]."Initialized" if ($ARGV[0] ne "ecmd");
+    $fastcheck .= " && !ecmdProfileActive";
+    $printout .= "#ifndef ECMD_STRIP_DEBUG\n";
+    $printout .= "  if ($fastcheck && ecmdClientDebug == 0) {\n";
+    $printout .= "#else\n";
+    $printout .= "  if ($fastcheck) {\n";
+    $printout .= "#endif\n";
+    $printout .= "   $type rc;\n" unless ($type_flag == $VOID);
+    $printout .= $ringcheck;
+    if ($type_flag == $VOID) {
+      $printout .= "   (*".$DllFns.".$funcname)($argstring);\n";
+    } else {
+      $printout .= "   rc = (*".$DllFns.".$funcname)($argstring);\n";
+    }
+    $printout .= $topologyflush;
+    $printout .= $errorcheck;
+    if ($type_flag == $VOID) {
+      $printout .= "  return;\n";
+    } else {
+      $printout .= "  return rc;\n";
+    }
+    $printout .= "  }\n";
+    $printout .= "#endif\n\n";
 
+    # Time the call if the profiler is on, against the target if the function takes one
+    my $profileTarget = "NULL";
+    foreach my $curarg (@argnames) {
+      my @argsplit = split /\s+/, $curarg;
+      my $tmparg = pop @argsplit;
+      my $tmptypestring = join(" ", @argsplit);
+      $tmptypestring =~ s/^\s+|\s+$//g;
+      if ($tmptypestring =~ /^(const\s+)?ecmdChipTarget(\s*&)?$/) {
+        $profileTarget = "&$tmparg";
+        last;
+      }
+    }
+    $printout .= "  if (ecmdProfileActive) {\n";
+    $printout .= "    ecmdProfileScope profileScope(\"$orgfuncname\", $profileTarget);\n";
+    $printout .= "    return ${funcname}Traced($argstring);\n";
+    $printout .= "  }\n";
+    $printout .= "  return ${funcname}Traced($argstring);\n";
     $printout .= "}\n\n";
+    $printout .= $body;
+
+    # Entries for the typed function table and the code that fills it in
+    $DllFnsOut .= "  $type (*$funcname)($typestring);\n";
+    $bindOut .= "  $DllFns.$funcname = ($type(*)($typestring))(void*)dlsym(dlHandle, \"$funcname\");\n";
+    $bindOut .= "  ".$DllFnTable."[$enumname] = (void*)$DllFns.$funcname;\n";
 
   }
 
@@ -406,6 +493,14 @@ if ($ARGV[1] =~ /DllCapi.H/ || $genAll) {
     print OUT "uint32_t dllSpecificCommandArgs(int*  io_argc, char** io_argv[]);\n\n";
     print OUT "/* Dll Specific Return Codes */\n";
     print OUT "std::string dllSpecificParseReturnCode(uint32_t i_returnCode);\n\n";
+    print OUT "/* Dll Common scom poll - reads with dllGetScom until the value matches, plugins with their own dllPollScom fall back to it */\n";
+    print OUT "uint32_t dllPollScomLoop(ecmdChipTarget & i_target, uint64_t i_address, ecmdDataBuffer & i_expected, ecmdDataBuffer & i_mask, uint32_t i_intervalUs, uint32_t i_timeoutMs, ecmdDataBuffer & o_data, uint32_t & o_iterations);\n\n";
+    print OUT "/* Dll Common thread safety check - true if the plugin was built with ECMD_DLL_THREAD_SAFE, so any of its functions can be called from several threads at once */\n";
+    print OUT "bool dllThreadSafe();\n\n";
+    print OUT "/* Dll Common output capture - ecmdLooperParallelCapture hands the calling thread's queue over here */\n";
+    print OUT "void dllOutputCapture(ecmdLooperParallelTarget * io_capture);\n";
+    print OUT "/* Dll Common output capture check - plugins call this first in dllOutput/dllOutputWarning/dllOutputError and skip printing when it returns true */\n";
+    print OUT "bool dllOutputCaptured(const char * i_message, ecmdLooperOutputType_t i_type);\n\n";
 
   } else {
     print OUT "/* Extension initialization function - verifies version */\n";
@@ -512,6 +607,25 @@ if ($ARGV[1] =~ /ClientCapiFunc.C/ || $genAll) {
   print OUT "extern bool ecmdDebugOutput;\n";
   print OUT "#endif\n\n\n";
 
+  # The typed function table, filled in all at once right after the plugin is loaded
+  my $DllFns = ($ARGV[0] ne "ecmd") ? "$ARGV[0]DllFns" : "DllFns";
+  print OUT "#ifndef ECMD_STATIC_FUNCTIONS\n";
+  print OUT "/* Plugin functions resolved up front by $ARGV[0]BindDllFunctions, a NULL entry or ecmdClientDebug sends the call down the traced path */\n";
+  print OUT "struct $ARGV[0]DllFunctions_t {\n";
+  print OUT $DllFnsOut;
+  print OUT "};\n";
+  print OUT "static $ARGV[0]DllFunctions_t $DllFns;\n\n";
+
+  print OUT "void $ARGV[0]BindDllFunctions() {\n";
+  print OUT "  $DllFns = $ARGV[0]DllFunctions_t();\n";
+  print OUT $bindOut;
+  print OUT "}\n\n";
+
+  print OUT "void $ARGV[0]UnbindDllFunctions() {\n";
+  print OUT "  $DllFns = $ARGV[0]DllFunctions_t();\n";
+  print OUT "}\n";
+  print OUT "#endif\n\n\n";
+
   print OUT $printout;
 
   print OUT "/* The previous has been auto-generated by makedll.pl */\n";